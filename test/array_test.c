@@ -41,4 +41,40 @@ SL void ArrayTest() {
   }
 }
 PE_REGISTER_TEST(&ArrayTest, "ArrayTest", SMALL);
+
+SL void LargeMemoryTest() {
+  LargeMemory& lm = GlobalLargeMemory();
+  const int64 used = lm.used_size();
+  {
+    DArray<int64, 2, LmAllocator> arr({1024, 1024});
+    assert(lm.used_size() >= used + 1024 * 1024 * 8);
+    for (int i = 0; i < 1024; ++i) {
+      for (int j = 0; j < 1024; ++j) arr[i][j] = i * j;
+    }
+    assert(arr[1023][1023] == 1023 * 1023);
+
+    LmVector<int> large(1 << 20, 1), small(100, 2);
+    assert(lm.used_size() >= used + (1 << 22) + 1024 * 1024 * 8);
+    large.resize(1 << 21, 3);
+    assert(large[0] == 1 && large[(1 << 21) - 1] == 3 && small[99] == 2);
+    assert(lm.peak_size() >= lm.used_size());
+  }
+  assert(lm.used_size() == used);
+
+  int* data = NewLargeArray<int>(1 << 20);
+  data[(1 << 20) - 1] = 1;
+  DeleteLargeArray(data);
+  assert(lm.used_size() == used);
+
+  // The huge pages are opt-in.
+  for (int huge_pages : {1, 2}) {
+    lm.set_huge_pages(huge_pages);
+    LmVector<int64> v(1 << 19, 7);
+    assert(v[(1 << 19) - 1] == 7);
+  }
+  lm.set_huge_pages(0);
+  assert(lm.used_size() == used);
+}
+
+PE_REGISTER_TEST(&LargeMemoryTest, "LargeMemoryTest", SMALL);
 }  // namespace array_test
\ No newline at end of file
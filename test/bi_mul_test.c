@@ -49,6 +49,63 @@ SL void BiMulTestBig_BigInteger() { BiMulTestImpl<BigInteger>(10, 10000); }
 PE_REGISTER_TEST(&BiMulTestBig_BigInteger, "BiMulTestBig_BigInteger", BIG);
 #endif
 
+SL BigInteger BiFromLimbs(const std::vector<uint32>& limbs) {
+  BigInteger ret = 0;
+  for (int i = static_cast<int>(std::size(limbs)) - 1; i >= 0; --i) {
+    ret *= 65536u;
+    ret *= 65536u;
+    ret += limbs[i];
+  }
+  return ret;
+}
+
+SL void BiMulTiersTest() {
+  auto random_limbs = [](int n) {
+    std::vector<uint32> limbs(n);
+    for (auto& v : limbs) v = static_cast<uint32>(CRand63());
+    // All-ones limbs stress the carries.
+    if (n > 8) std::fill(std::begin(limbs), std::begin(limbs) + n / 4, ~0u);
+    limbs.back() |= 1;
+    return limbs;
+  };
+  // Covers schoolbook, Karatsuba, unbalanced slices and NTT.
+  const std::vector<std::pair<int, int>> shapes = {
+      {2, 2},     {31, 31},   {32, 32},    {33, 33},     {47, 47},
+      {48, 48},   {49, 49},   {100, 77},   {500, 400},   {700, 90},
+      {639, 639}, {640, 640}, {1000, 999}, {1500, 1450}, {3000, 2500}};
+  for (auto [n, m] : shapes) {
+    const std::vector<uint32> la = random_limbs(n);
+    const std::vector<uint32> lb = random_limbs(m);
+    const BigInteger a = BiFromLimbs(la);
+    const BigInteger b = BiFromLimbs(lb);
+
+    std::vector<uint32> expected(n + m);
+    internal::BiMulBasecase(std::data(la), n, std::data(lb), m,
+                            std::data(expected));
+    while (expected.back() == 0) expected.pop_back();
+    const BigInteger c = -a * b;
+    assert(c < 0);
+    assert(std::size(c) == static_cast<int>(std::size(expected)));
+    for (int i = 0; i < static_cast<int>(std::size(expected)); ++i) {
+      assert((-c)[i] == expected[i]);
+    }
+
+    std::vector<uint32> expected_square(2 * n);
+    internal::BiMulBasecase(std::data(la), n, std::data(la), n,
+                            std::data(expected_square));
+    while (expected_square.back() == 0) expected_square.pop_back();
+    const BigInteger d = a * a;
+    assert(std::size(d) == static_cast<int>(std::size(expected_square)));
+    for (int i = 0; i < static_cast<int>(std::size(expected_square)); ++i) {
+      assert(d[i] == expected_square[i]);
+    }
+  }
+  assert(Power(BigInteger(3), 20000) % 1000000007 ==
+         PowerMod(3, 20000, 1000000007));
+}
+
+PE_REGISTER_TEST(&BiMulTiersTest, "BiMulTiersTest", SMALL);
+
 #if ENABLE_GMP
 SL void BiMulTestMedium_MpInteger() { BiMulTestImpl<MpInteger>(1000, 500); }
 
@@ -0,0 +1,263 @@
+#include "pe_test.h"
+
+namespace db_test {
+using Table = PeDbTable<TableItem<int64>>;
+
+// A fresh directory for the files of a test.
+SL std::string MakeTestDirectory(const std::string& name) {
+  const std::filesystem::path dir =
+      std::filesystem::temp_directory_path() /
+      ("pe_db_test_" + name + "_" + std::to_string(CRand63()));
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  return dir.string() + "/";
+}
+
+SL std::vector<TableItem<int64>> MakeItems(int64 first, int64 count,
+                                           int64 value) {
+  std::vector<TableItem<int64>> items;
+  for (int64 i = 0; i < count; ++i) {
+    items.emplace_back(first + i, value + i);
+  }
+  return items;
+}
+
+SL void TornLogTest() {
+  const std::string dir = MakeTestDirectory("torn_log");
+  const std::string log_file = dir + "t.log";
+  {
+    Table table;
+    table.Merge(MakeItems(0, 100, 1000));
+    table.AppendLog(log_file);
+  }
+  {
+    // An append interrupted in the middle of the items.
+    Table table;
+    table.Merge(MakeItems(100, 100, 2000));
+    table.AppendLog(log_file);
+    std::filesystem::resize_file(log_file,
+                                 std::filesystem::file_size(log_file) - 5);
+  }
+  {
+    // The next append must not be hidden behind the torn run.
+    Table table;
+    table.Merge(MakeItems(200, 100, 3000));
+    table.AppendLog(log_file);
+  }
+  {
+    Table table;
+    assert(table.LoadLog(log_file) == 2);
+    assert(table.Find(150) == nullptr);
+    assert(table.Find(50)->value == 1050);
+    assert(table.Find(250)->value == 3050);
+  }
+
+  // Loading cuts the torn tail off.
+  const int64 size_with_two_runs = std::filesystem::file_size(log_file);
+  {
+    std::ofstream out(log_file, std::ios::binary | std::ios::app);
+    out << "garbage";
+  }
+  {
+    Table table;
+    assert(table.LoadLog(log_file) == 2);
+    assert(static_cast<int64>(std::filesystem::file_size(log_file)) ==
+           size_with_two_runs);
+    table.Merge(MakeItems(300, 10, 4000));
+    table.AppendLog(log_file);
+  }
+  {
+    Table table;
+    assert(table.LoadLog(log_file) == 3);
+    assert(table.Find(305)->value == 4005);
+  }
+  std::filesystem::remove_all(dir);
+}
+
+PE_REGISTER_TEST(&TornLogTest, "TornLogTest", SMALL);
+
+SL void TableFormatTest() {
+  const std::string dir = MakeTestDirectory("format");
+  const std::string file = dir + "t";
+  // Unsorted with a duplicate n, the later item wins.
+  std::vector<TableItem<int64>> items = MakeItems(0, 1000, 0);
+  for (auto& item : items) {
+    item.n = item.n * 7919 % 1000 * 2;
+    item.value = item.n;
+  }
+  items.emplace_back(items[10].n, -1);
+  Table::SaveRecords(file, items);
+
+  std::vector<char> content(std::filesystem::file_size(file));
+  {
+    std::ifstream in(file, std::ios::binary);
+    in.read(std::data(content), std::size(content));
+  }
+  TableHeader header;
+  assert(Table::ParseHeader(file, std::data(content), std::size(content),
+                            header) == 1);
+  assert(header.item_count == 1000);
+  assert(header.index_stride == kTableIndexStride);
+  assert(header.index_count == (1000 + kTableIndexStride - 1) /
+                                   kTableIndexStride);
+  const char* payload = std::data(content) + header.header_size;
+  assert(Table::VerifyChecksum(header, payload));
+  const std::vector<TableItem<int64>> loaded = Table::LoadRecords(file);
+  assert(std::size(loaded) == 1000);
+  for (int64 i = 0; i < 1000; ++i) {
+    assert(loaded[i].n == 2 * i);
+    assert(loaded[i].value == (2 * i == items[10].n ? -1 : 2 * i));
+  }
+
+  // A flipped bit is caught by the checksums.
+  TableHeader changed = header;
+  ++changed.item_count;
+  assert(internal::TableHeaderChecksum(changed) != header.header_checksum);
+  content[header.header_size + 3 * sizeof(TableItem<int64>)] ^= 1;
+  assert(!Table::VerifyChecksum(header, payload));
+  std::filesystem::remove_all(dir);
+}
+
+PE_REGISTER_TEST(&TableFormatTest, "TableFormatTest", SMALL);
+
+SL void LegacyTableTest() {
+  const std::string dir = MakeTestDirectory("legacy");
+  const std::string file = dir + "t";
+  std::vector<TableItem<int64>> items = MakeItems(0, 300, 5);
+  std::reverse(std::begin(items), std::end(items));
+  {
+    LegacyTableHeader header{sizeof(LegacyTableHeader), 0};
+    std::ofstream out(file, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(std::data(items)),
+              std::size(items) * sizeof(items[0]));
+  }
+  for (int map : {0, 1}) {
+    Table table;
+    if (map) {
+      // The legacy files are loaded instead.
+      table.Map(file);
+    } else {
+      table.Load(file);
+    }
+    assert(!table.is_mapped());
+    assert(table.size() == 300);
+    for (int64 i = 0; i < 300; ++i) {
+      assert(table[i].n == i && table[i].value == i + 5);
+    }
+  }
+  std::filesystem::remove_all(dir);
+}
+
+PE_REGISTER_TEST(&LegacyTableTest, "LegacyTableTest", SMALL);
+
+SL void MapAndLoadTest() {
+  const std::string dir = MakeTestDirectory("map");
+  const std::string file = dir + "t";
+  // Many index blocks, the items are at the even n.
+  const int64 count = 10 * kTableIndexStride + 17;
+  std::vector<TableItem<int64>> items;
+  for (int64 i = 0; i < count; ++i) items.emplace_back(2 * i + 10, 3 * i);
+  Table::SaveRecords(file, items);
+
+  Table loaded, mapped, verified;
+  loaded.Load(file);
+  mapped.Map(file);
+  verified.Map(file, 1);
+  assert(!loaded.is_mapped() && mapped.is_mapped() && verified.is_mapped());
+  for (const Table* table : {&loaded, &mapped, &verified}) {
+    assert(table->size() == count);
+    assert(table->source() == file);
+    for (int64 n = 0; n < 2 * count + 20; ++n) {
+      const TableItem<int64>* item = table->Find(n);
+      if (n >= 10 && n % 2 == 0 && n < 2 * count + 10) {
+        assert(item != nullptr && item->value == 3 * ((n - 10) / 2));
+      } else {
+        assert(item == nullptr);
+      }
+    }
+    // The queries in ascending order, with gaps of several index blocks.
+    int64 pos = 0;
+    for (int64 n = 0; n < 2 * count + 20; n += 1 + CRand63() % 2000) {
+      const TableItem<int64>* item = table->FindNext(n, pos);
+      assert(item == table->Find(n));
+      assert(pos <= table->size());
+    }
+  }
+
+  // The runs merged in memory take precedence over the base.
+  mapped.Merge({TableItem<int64>(10, -1), TableItem<int64>(11, -2)});
+  int64 pos = 0;
+  assert(mapped.FindNext(10, pos)->value == -1);
+  assert(mapped.FindNext(11, pos)->value == -2);
+  assert(mapped.FindNext(12, pos)->value == 3);
+  mapped.Save(file);
+  assert(!mapped.is_mapped() && mapped.size() == count + 1);
+  loaded.Map(file, 1);
+  assert(loaded.Find(10)->value == -1 && loaded.Find(11)->value == -2);
+  std::filesystem::remove_all(dir);
+}
+
+PE_REGISTER_TEST(&MapAndLoadTest, "MapAndLoadTest", SMALL);
+
+SL void PrefixSumStoreTest() {
+  const std::string dir = MakeTestDirectory("store");
+  const int64 n = 100000;
+  DVAPrefixSumMaker<int64> plain(n);
+  const DVA<int64>& mu = plain.Mu();
+  const DVA<int64>& phi = plain.Phi();
+  using T = NModCC64<1000000007>;
+  {
+    PeDb db(dir);
+    PeDbPrefixSumStore<int64> store(db);
+    DVAPrefixSumMaker<int64> maker(n, &store);
+    maker.Mu();
+    maker.Phi();
+    PeDbPrefixSumStore<T> mod_store(db);
+    DVAPrefixSumMaker<T> mod_maker(n, &mod_store);
+    mod_maker.Phi();
+    db.Save();
+  }
+  const std::string mu_table = dir + kNamedTablePrefix + "Ntf" +
+                               std::to_string(static_cast<int>(Ntf::Mu));
+  assert(std::filesystem::exists(mu_table + "_i64_0"));
+
+  PeDb db(dir);
+  db.Map(1);
+  PeDbPrefixSumStore<int64> store(db);
+  DVA<int64> dva(n);
+  assert(store.Fill(Ntf::Mu, dva));
+  for (int64 i = 0; i < dva.key_size; ++i) {
+    assert(dva.values[i] == mu.values[i]);
+  }
+  // The maker takes the values from the store.
+  DVAPrefixSumMaker<int64> maker(n, &store);
+  const DVA<int64>& stored_phi = maker.Phi();
+  for (int64 i = 0; i < stored_phi.key_size; ++i) {
+    assert(stored_phi.values[i] == phi.values[i]);
+  }
+
+  PeDbPrefixSumStore<T> mod_store(db);
+  DVA<T> mod_dva(n);
+  assert(mod_store.Fill(Ntf::Phi, mod_dva));
+  for (int64 i = 0; i < mod_dva.key_size; ++i) {
+    assert(mod_dva.values[i].value() == phi.values[i] % 1000000007);
+  }
+
+  // The value types of the same size but another kind are not mixed up.
+  PeDbPrefixSumStore<uint64> unsigned_store(db);
+  DVA<uint64> unsigned_dva(n);
+  assert(!unsigned_store.Fill(Ntf::Mu, unsigned_dva));
+  PeDbPrefixSumStore<double> double_store(db);
+  DVA<double> double_dva(n);
+  assert(!double_store.Fill(Ntf::Mu, double_dva));
+  assert(internal::TableValueTypeTag<TableItem<int64>>() !=
+         internal::TableValueTypeTag<TableItem<uint64>>());
+  assert(internal::TableValueTypeTag<TableItem<int64>>() !=
+         internal::TableValueTypeTag<TableItem<double>>());
+  db.Unload();
+  std::filesystem::remove_all(dir);
+}
+
+PE_REGISTER_TEST(&PrefixSumStoreTest, "PrefixSumStoreTest", SMALL);
+}  // namespace db_test
@@ -41,9 +41,31 @@ SL void TestS1() {
   assert(orz[1000000] == 37550402023LL);
 }
 
+SL void TestReuse() {
+  const int64 n = 1000000;
+  const auto a = PrimeS0Ex<int64>(n);
+  const auto b = PrimeS1Ex<int64>(n);
+  DVA<int64> c;
+  DVAAdd(a, b, c);
+  assert(c.values == (a + b).values);
+  const int64* data = std::data(c.values);
+  c -= b;
+  assert(c.values == a.values);
+  DVAConv(a, b, c);
+  assert(c.values == (a * b).values);
+  assert(std::data(c.values) == data);
+  DVAConvDivSquare(a, b, c);
+  assert(c.values == DVAConvDivSquare(a, b).values);
+
+  c.Resize(n / 7, 1);
+  assert(c.values == DVA<int64>(n / 7, 1).values);
+  assert(c.keys == DVA<int64>(n / 7, 1).keys);
+}
+
 SL void DvaTest() {
   TestS0();
   TestS1();
+  TestReuse();
 }
 
 PE_REGISTER_TEST(&DvaTest, "DvaTest", SMALL);
@@ -368,4 +368,63 @@ SL void MatMulTest() {
 
 PE_REGISTER_TEST(&MatMulTest, "MatMulTest", SUPER);
 #endif
+
+SL void MatMulModKernelTest() {
+  for (int64 mod : std::vector<int64>{97, 1000000007, 2147483647,
+                                      1000000000000000003}) {
+    for (auto [r, m, n] : std::vector<std::tuple<int, int, int>>{
+             {1, 1, 1}, {5, 7, 3}, {37, 300, 513}}) {
+      PeMatrix<int64> a(r, m), b(m, n);
+      for (int i = 0; i < r; ++i)
+        for (int k = 0; k < m; ++k) a(i, k) = CRand63() % mod;
+      for (int k = 0; k < m; ++k)
+        for (int j = 0; j < n; ++j) b(k, j) = CRand63() % mod;
+      SetMatrixMulThreadCount(3);
+      PeMatrix<int64> c = MatrixMul(a, b, mod);
+      SetMatrixMulThreadCount(0);
+      for (int i = 0; i < r; ++i)
+        for (int j = 0; j < n; ++j) {
+          int64 s = 0;
+          for (int k = 0; k < m; ++k) {
+            s = AddMod(s, MulMod(a(i, k), b(k, j), mod), mod);
+          }
+          assert(c(i, j) == s);
+        }
+    }
+  }
+  {
+    constexpr int N = 9;
+    int64 a[N][N], c[N][N];
+    for (int i = 0; i < N; ++i)
+      for (int j = 0; j < N; ++j) a[i][j] = i * N + j;
+    MatMulMatMod(a, a, c, 1000000007, N);
+    for (int i = 0; i < N; ++i)
+      for (int j = 0; j < N; ++j) {
+        int64 s = 0;
+        for (int k = 0; k < N; ++k) s += a[i][k] * a[k][j];
+        assert(c[i][j] == s);
+      }
+  }
+#if PE_HAS_INT128
+  {
+    // The modulus truncated to 64 bits is 13, which must not pick the
+    // 32-bit kernel.
+    const int128 mod = (static_cast<int128>(1) << 64) + 13;
+    PeMatrix<int128> a(4, 4), b(4, 4);
+    for (int i = 0; i < 4; ++i)
+      for (int j = 0; j < 4; ++j) {
+        a(i, j) = 1000 + i * 4 + j;
+        b(i, j) = 2000 + i * 4 + j;
+      }
+    PeMatrix<int128> c = MatrixMul(a, b, mod);
+    for (int i = 0; i < 4; ++i)
+      for (int j = 0; j < 4; ++j) {
+        int128 s = 0;
+        for (int k = 0; k < 4; ++k) s += a(i, k) * b(k, j);
+        assert(c(i, j) == s);
+      }
+  }
+#endif
+}
+PE_REGISTER_TEST(&MatMulModKernelTest, "MatMulModKernelTest", SMALL);
 }  // namespace mat_mul_test
@@ -117,4 +117,89 @@ SL void FracModTest() {
 
 PE_REGISTER_TEST(&FracModTest, "FracModTest", SMALL);
 #endif
+
+SL void Montgomery64Test() {
+  for (uint64 mod : {3ULL, 1000000007ULL, 4611686018427387903ULL,
+                     9223372036854775807ULL, 18446744073709551557ULL}) {
+    const Montgomery64 mont(mod);
+    assert(mont.From(mont.One()) == 1);
+    for (int i = 0; i < 1000; ++i) {
+      const uint64 a = static_cast<uint64>(CRand63()) * 2 + (i & 1);
+      const uint64 b = static_cast<uint64>(CRand63()) * 3 + i;
+      const uint64 ma = mont.To(a), mb = mont.To(b);
+      assert(mont.From(ma) == a % mod);
+      assert(mont.From(mont.Mul(ma, mb)) == MulMod(a % mod, b % mod, mod));
+      assert(mont.From(mont.Power(ma, b)) == PowerMod(a, b, mod));
+      assert(mont.Sub(mont.Add(ma, mb), mb) == ma);
+      if (mod >> 63) continue;
+      assert(mont.From(mont.Add(ma, mb)) == AddMod(a % mod, b % mod, mod));
+      assert(mont.From(mont.Sub(ma, mb)) == SubMod(a % mod, b % mod, mod));
+    }
+  }
+}
+
+PE_REGISTER_TEST(&Montgomery64Test, "Montgomery64Test", SMALL);
+
+SL void Barrett32Test() {
+  for (uint64 mod : {1ULL, 2ULL, 1000000007ULL, 2147483647ULL}) {
+    const Barrett32 barrett(mod);
+    for (int i = 0; i < 1000; ++i) {
+      const uint64 a = barrett.To(CRand63()), b = barrett.To(CRand63());
+      assert(barrett.Mul(a, b) == MulMod(a, b, mod));
+      assert(barrett.Add(a, b) == AddMod(a, b, mod));
+      assert(barrett.Sub(a, b) == SubMod(a, b, mod));
+      assert(barrett.Power(a, b) == PowerMod(a, b, mod));
+    }
+  }
+}
+
+PE_REGISTER_TEST(&Barrett32Test, "Barrett32Test", SMALL);
+
+template <typename T>
+SL void TestNModNumberR(int64 mod) {
+  using MT = NModTL64<>;
+  TLMod64::Set(mod);
+  for (int i = 0; i < 1000; ++i) {
+    const int64 a = CRand63() - (i & 1 ? 0 : CRand63());
+    const int64 b = CRand63() - (i & 2 ? 0 : CRand63());
+    const T x(a), y(b);
+    const MT u(a), v(b);
+    assert(x.value() == u.value());
+    assert((x + y).value() == (u + v).value());
+    assert((x - y).value() == (u - v).value());
+    assert((x * y).value() == (u * v).value());
+    assert((-x).value() == (-u).value());
+    assert((x * 3 - 1).value() == (u * 3 - 1).value());
+    assert(x.Power(b & 1023).value() == u.Power(b & 1023).value());
+    T z = x;
+    ++z;
+    z *= y;
+    z -= x;
+    assert(z.value() == ((u + 1) * v - u).value());
+    z.SetValue(u.value());
+    assert(z == x);
+  }
+
+  std::vector<T> inv(1000);
+  InitInverse(Span<T>(inv));
+  for (int i = 1; i < 1000; ++i) {
+    assert(i % mod == 0 || (inv[i] * i).value() == 1);
+  }
+}
+
+SL void NModNumberRTest() {
+  for (int64 mod : {1000000007LL, 2147483647LL, 4611686018427387847LL}) {
+    TLReducerMod<Montgomery64>::Set(mod);
+    TestNModNumberR<NModMontTL64>(mod);
+    GlobalReducerMod<Montgomery64>::Set(mod);
+    TestNModNumberR<NModMontGlobal64>(mod);
+    if (mod < (1LL << 31)) {
+      TLReducerMod<Barrett32>::Set(mod);
+      TestNModNumberR<NModBarrettTL>(mod);
+    }
+  }
+  TestNModNumberR<NModMontCC64<1000000007>>(1000000007);
+}
+
+PE_REGISTER_TEST(&NModNumberRTest, "NModNumberRTest", SMALL);
 }  // namespace mod_test
@@ -703,6 +703,211 @@ SL void ArithFuncTest() {
 
 PE_REGISTER_TEST(&ArithFuncTest, "ArithFuncTest", SMALL);
 
+SL void SegmentedSieveTest() {
+  const int64 b = kSegmentedSieveBlockSize;
+  for (int64 n : std::vector<int64>{1, 2, 100, b - 1, b, b + 1, maxp}) {
+    std::vector<int> s_pmask(n + 1), s_plist(n + 100), s_phi(n + 1),
+        s_mu(n + 1), s_rad(n + 1), s_sigma0(n + 1);
+    std::vector<int64> s_sigma1(n + 1);
+    const int s_pcnt = internal::SegmentedSieve(
+        n, std::data(s_pmask), nullptr, std::data(s_plist), std::data(s_phi),
+        std::data(s_mu), std::data(s_rad), std::data(s_sigma0),
+        std::data(s_sigma1));
+
+    assert(s_pcnt == std::upper_bound(plist, plist + pcnt, n) - plist);
+    for (int i = 0; i < s_pcnt; ++i) {
+      assert(s_plist[i] == plist[i]);
+    }
+    for (int64 i = 1; i <= n; ++i) {
+      assert(s_pmask[i] == pmask[i]);
+      assert(s_phi[i] == CalPhi(i));
+      assert(s_mu[i] == CalMu(i));
+      assert(s_rad[i] == CalRad(i));
+      assert(s_sigma0[i] == CalSigma0(i));
+      assert(s_sigma1[i] == CalSigma1(i));
+    }
+  }
+}
+
+PE_REGISTER_TEST(&SegmentedSieveTest, "SegmentedSieveTest", SMALL);
+
+SL void CompactPmaskTest() {
+  std::vector<std::uint16_t> c_pmask16(maxp / 2 + 1);
+  std::vector<int> c_plist(pcnt + 100);
+  const int c_pcnt = internal::SegmentedSieve(
+      maxp, nullptr, std::data(c_pmask16), std::data(c_plist), nullptr,
+      nullptr, nullptr, nullptr, nullptr);
+  assert(c_pcnt == pcnt);
+  assert(std::equal(plist, plist + pcnt, std::data(c_plist)));
+
+  std::vector<int> expected_pmask(pmask, pmask + maxp + 1);
+  std::vector<IntegerFactorization> expected_factorization;
+  for (int64 n = 1; n <= 100000; ++n) {
+    expected_factorization.push_back(Factorize(maxp - n));
+  }
+
+  // Switch to the compact pmask.
+  int* saved_pmask = pmask;
+  pmask = nullptr;
+  pmask16 = std::data(c_pmask16);
+  for (int64 n = 1; n <= maxp; ++n) {
+    assert(GetPmask(n) == expected_pmask[n]);
+  }
+  for (int64 n = 1; n <= 100000; ++n) {
+    assert(Factorize(maxp - n) == expected_factorization[n - 1]);
+    assert(IsPrime(maxp - n) == (expected_pmask[maxp - n] == maxp - n));
+  }
+  pmask16 = nullptr;
+  pmask = saved_pmask;
+}
+
+PE_REGISTER_TEST(&CompactPmaskTest, "CompactPmaskTest", SMALL);
+
+SL void CheckFactorization(int64 n, const IntegerFactorization& f) {
+  int64 v = 1;
+  for (int i = 0; i < static_cast<int>(std::size(f)); ++i) {
+    assert(IsPrimeEx(f[i].first));
+    assert(i == 0 || f[i - 1].first < f[i].first);
+    for (int j = 0; j < f[i].second; ++j) v *= f[i].first;
+  }
+  assert(v == n);
+}
+
+SL bool SameFactors(const IntegerFactorization& f,
+                    const std::vector<std::pair<int64, int>>& expected) {
+  return static_cast<const std::vector<std::pair<int64, int>>&>(f) ==
+         expected;
+}
+
+SL void FactorizeLargeTest() {
+  // Strong pseudoprimes and Carmichael numbers.
+  for (int64 n : {2047LL, 1373653LL, 25326001LL, 3215031751LL,
+                  2152302898747LL, 3474749660383LL, 341550071728321LL,
+                  3825123056546413051LL, 561LL, 41041LL, 825265LL,
+                  321197185LL}) {
+    assert(!IsPrimeEx(n));
+    CheckFactorization(n, Factorize(n));
+  }
+
+  const int64 large_primes[] = {1000000007LL,          1000000009LL,
+                                2147483647LL,          4294967291LL,
+                                1000000000039LL,       999999999989LL,
+                                3037000493LL,          9223372036854775783LL,
+                                4611686018427387847LL, 1000000000000000003LL};
+  for (int64 p : large_primes) {
+    assert(IsPrimeEx(p));
+    assert(SameFactors(Factorize(p), {{p, 1}}));
+  }
+
+  // Semiprimes and prime powers beyond maxp^2.
+  assert(SameFactors(Factorize(3037000493LL * 3037000493LL),
+                     {{3037000493LL, 2}}));
+  assert(SameFactors(Factorize(1000000007LL * 1000000009LL),
+                     {{1000000007LL, 1}, {1000000009LL, 1}}));
+  assert(SameFactors(Factorize(2LL * 2147483647LL * 2147483647LL),
+                     {{2, 1}, {2147483647LL, 2}}));
+  assert(SameFactors(FactorizePower(1000003LL * 999999999989LL, 3),
+                     {{1000003LL, 3}, {999999999989LL, 3}}));
+  assert(CalMu(1000000007LL * 1000000009LL) == 1);
+  assert(CalMu(1000003LL * 1000003LL * 1000033LL) == 0);
+  assert(CalPhi(1000000007LL * 1000000009LL) ==
+         1000000006LL * 1000000008LL);
+  assert(CalRad(1000003LL * 1000003LL * 1000033LL) == 1000003LL * 1000033LL);
+  assert(CalSigma0(1000003LL * 1000003LL * 1000033LL) == 6);
+  assert(IsSquareFree(1000003LL * 1000003LL * 1000033LL) == 0);
+  assert(std::size(GetFactors(1000000007LL * 1000000009LL)) == 4);
+
+  for (int i = 0; i < 2000; ++i) {
+    const int64 n = CRand63() >> (i % 40);
+    if (n <= 1) continue;
+    const IntegerFactorization f = Factorize(n);
+    CheckFactorization(n, f);
+    const InlineIntegerFactorization g = FactorizeInline(n);
+    assert(std::equal(std::begin(f), std::end(f), std::begin(g), std::end(g)));
+  }
+  // The product of the first 15 primes.
+  assert(std::size(FactorizeInline(614889782588491410LL)) ==
+         kMaxDistinctPrimeFactors);
+
+  // Compare with trial division.
+  for (int64 n = maxp2 - 100; n <= maxp2 + 100; ++n) {
+    std::vector<std::pair<int64, int>> expected;
+    int64 m = n;
+    for (int64 p = 2; p * p <= m; ++p) {
+      int c = 0;
+      while (m % p == 0) m /= p, ++c;
+      if (c) expected.emplace_back(p, c);
+    }
+    if (m > 1) expected.emplace_back(m, 1);
+    assert(SameFactors(Factorize(n), expected));
+  }
+}
+
+PE_REGISTER_TEST(&FactorizeLargeTest, "FactorizeLargeTest", SMALL);
+
+SL void IsPrimeExBatchTest() {
+  std::vector<int64> data{0,       1,       2,          3,         4,
+                          17,      71,      73,         maxp - 1,  maxp,
+                          maxp + 1, maxp2,  maxp2 + 1,  2047,      3215031751LL,
+                          341550071728321LL, 3825123056546413051LL,
+                          9223372036854775783LL, 9223372036854775807LL};
+  for (int i = 0; i < 10000; ++i) {
+    data.push_back(CRand63() >> (i % 60) | 1);
+  }
+  const std::vector<int> result = IsPrimeExBatch(data);
+  for (int64 i = 0; i < static_cast<int64>(std::size(data)); ++i) {
+    assert(result[i] == IsPrimeEx(data[i]));
+  }
+}
+
+PE_REGISTER_TEST(&IsPrimeExBatchTest, "IsPrimeExBatchTest", SMALL);
+
+SL void PrimesInRangeTest() {
+  const std::vector<std::pair<int64, int64>> ranges{
+      {-10, 1000},
+      {maxp - 1000, maxp + 1000},
+      {maxp2 - 10000, maxp2 + 10000},
+      {1000000000LL - 1, 1000000000LL + 5000000},
+      {1000000000000LL, 1000000000000LL + 1500000},
+      {1000000000000000000LL, 1000000000000000000LL + 20000},
+      {9223372036854775807LL - 20000, 9223372036854775807LL}};
+  for (const auto& [start, end] : ranges) {
+    std::vector<int64> expected;
+    for (int64 i = std::max<int64>(start, 0); i <= end; ++i) {
+      if (IsPrimeEx(i)) expected.push_back(i);
+      if (i == end) break;
+    }
+    assert(GetPrimesInRangePe(start, end) == expected);
+
+    std::vector<int64> enumerated;
+    for (int64 p : PrimeEnumeratorPe<int64>(start, end)) {
+      enumerated.push_back(p);
+    }
+    assert(enumerated == expected);
+
+    std::vector<int64> streamed;
+    ForEachPrimeInRangePe(start, end, [&](int64 p) { streamed.push_back(p); });
+    assert(streamed == expected);
+  }
+
+  // Unbounded enumeration stops at the maximum value of T.
+  std::vector<int> enumerated;
+  for (int p : PrimeEnumeratorPe<int>(2147483647 - 1000)) {
+    enumerated.push_back(p);
+  }
+  assert(std::size(enumerated) == 47 && enumerated.back() == 2147483647);
+
+  int64 last = 1000000000000000000LL;
+  int count = 0;
+  for (int64 p : PrimeEnumeratorPe<int64>(last)) {
+    while (!IsPrimeEx(last)) ++last;
+    assert(p == last++);
+    if (++count == 1000) break;
+  }
+}
+
+PE_REGISTER_TEST(&PrimesInRangeTest, "PrimesInRangeTest", SMALL);
+
 SL void ExtractFactorInvOfTest() {
   // ExtractFactor(A, B): returns {A / B^k, k} for the largest k with B^k | A
   {
@@ -0,0 +1,47 @@
+#include "pe_test.h"
+
+namespace parallel_find_test {
+SL void ParallelFindTest() {
+  // Answers are dense near the end, so threads racing ahead must not win.
+  auto accept = [](int64 x) { return x >= 12345678 && x % 1000 == 7; };
+  std::function<bool(int64)> f = accept;
+  assert((ParallelFindFirst<4, int64>(1, 100000000, f)) == 12346007);
+  assert((ParallelFindFirst<4, int64>(1, 12346006, f)) == 12346007);
+  assert((ParallelFindFirst<4, int64>(1, f)) == 12346007);
+  assert((ParallelFindLast<4, int64>(1, 100000000, f)) == 99999007);
+  assert((ParallelFindLast<4, int64>(1, 12346006, f)) == 0);
+  assert((ParallelFindLast<4, int64>(99999006, f)) == 99998007);
+
+  std::function<int64(int64, int64)> first_block = [&](int64 a, int64 b) {
+    while (a <= b && !accept(a)) ++a;
+    return a;
+  };
+  std::function<int64(int64, int64)> last_block = [&](int64 a, int64 b) {
+    while (b >= a && !accept(b)) --b;
+    return b;
+  };
+  assert((ParallelFindFirst<3, int64, 7>(-5, 100000000, first_block)) ==
+         12346007);
+  assert((ParallelFindFirst<3, int64, 7>(-5, first_block)) == 12346007);
+  assert((ParallelFindLast<3, int64, 7>(-5, 50000000, last_block)) ==
+         49999007);
+  assert((ParallelFindLast<3, int64, 7>(50000000, last_block)) == 49999007);
+
+  // A range which does not fit in the difference of two ints.
+  std::function<bool(int)> g = [](int x) { return x % 999983 == 0; };
+  assert((ParallelFindFirst<4, int>(-2000000000, 2000000000, g)) ==
+         -1999966000);
+  assert((ParallelFindLast<4, int>(-2000000000, 2000000000, g)) ==
+         1999966000);
+
+  // Expensive candidates shrink the blocks.
+  std::function<bool(int64)> slow = [](int64 x) {
+    uint64 s = static_cast<uint64>(x);
+    for (int i = 0; i < 2000; ++i) s = s * 6364136223846793005ULL + 1;
+    return static_cast<int64>(s) != x && x == 5000;
+  };
+  assert((ParallelFindFirst<4, int64, 1000>(1, 1000000000, slow)) == 5000);
+}
+
+PE_REGISTER_TEST(&ParallelFindTest, "ParallelFindTest", SMALL);
+}  // namespace parallel_find_test
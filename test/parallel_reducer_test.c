@@ -0,0 +1,81 @@
+#include "pe_test.h"
+
+namespace parallel_reducer_test {
+SL void ParallelReducerTest() {
+  constexpr int n = 1000000;
+  std::vector<int64> data(n);
+  for (auto& v : data) v = CRand63() % 2000000001 - 1000000000;
+  const int64 mod = 1000000007;
+  int64 expected_sum = 0, expected_sum_mod = 0;
+  for (auto v : data) {
+    expected_sum += v;
+    expected_sum_mod = AddMod(expected_sum_mod, Mod(v, mod), mod);
+  }
+  const int64 expected_min =
+      *std::min_element(std::begin(data), std::end(data));
+  const int64 expected_max =
+      *std::max_element(std::begin(data), std::end(data));
+
+  PSum<int64> sum;
+  PSumMod<int64> sum_mod(mod);
+  PMin<int64> pmin;
+  PMin<int64> pmax;
+  PMin<std::pair<int64, int>> pmin_pair;
+  pmin.SetEnableLog(false);
+  pmax.SetEnableLog(false).SetInvertCmp(true);
+  pmin_pair.SetEnableLog(false);
+#if ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic, 1000) num_threads(4)
+#endif
+  for (int i = 0; i < n; ++i) {
+    sum += data[i];
+    sum_mod += Mod(data[i], mod);
+    pmin.CheckMin(data[i]);
+    pmax.CheckMin(data[i]);
+    pmin_pair.CheckMin({data[i], i});
+  }
+  assert(sum.value() == expected_sum);
+  assert(sum_mod.value() == expected_sum_mod);
+  assert(pmin.value() == expected_min);
+  assert(pmax.value() == expected_max);
+  assert(pmin_pair.value().first == expected_min);
+  // The global minimum is kept by both the lock-free and the locked paths.
+  assert(pmin.result.value() == expected_min);
+  assert(pmax.result.value() == expected_max);
+  assert(pmin_pair.result.value().first == expected_min);
+
+  // The slots grow for the std::threads beyond the slot count.
+  ParallelReducer<int64, std::plus<int64>> reducer(0, {}, 2);
+  assert(reducer.SlotCount() == 2);
+  std::vector<int> thread_ids(6);
+  std::atomic<int> started{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 6; ++t) {
+    threads.emplace_back([&, t]() {
+      // All the threads are alive together, so their ids differ.
+      thread_ids[t] = internal::ParallelThreadId();
+      ++started;
+      while (started < 6) std::this_thread::yield();
+      for (int i = t; i < n; i += 6) reducer.Update(data[i]);
+    });
+  }
+  for (auto& t : threads) t.join();
+  const int max_id = *std::max_element(std::begin(thread_ids),
+                                       std::end(thread_ids));
+  assert(max_id >= 5 && reducer.SlotCount() > max_id);
+  assert(reducer.Result() == expected_sum);
+  assert(reducer.Reset().Result() == 0);
+
+  // The ids of the exited threads are reused, so threads started one after
+  // another keep using the same slot.
+  std::vector<int> ids;
+  for (int t = 0; t < 20; ++t) {
+    std::thread([&]() { ids.push_back(internal::ParallelThreadId()); }).join();
+  }
+  assert(std::count(std::begin(ids), std::end(ids), ids[0]) == 20);
+  ParallelReducer<int64> default_reducer;
+  assert(ids[0] < default_reducer.SlotCount());
+}
+
+PE_REGISTER_TEST(&ParallelReducerTest, "ParallelReducerTest", SMALL);
+}  // namespace parallel_reducer_test
@@ -15,4 +15,95 @@ SL void ParallelSortTest() {
 }
 
 PE_REGISTER_TEST(&ParallelSortTest, "ParallelSortTest", SMALL);
+
+SL void ParallelSortTypesTest() {
+  {
+    std::vector<int64> arr(n);
+    for (auto& v : arr) v = CRand63() - (1LL << 62);
+    std::vector<int64> expected = arr;
+    std::sort(std::begin(expected), std::end(expected));
+    ParallelSort<3>(std::data(arr), std::data(arr) + n);
+    assert(arr == expected);
+  }
+  {
+    std::vector<double> arr(n);
+    for (auto& v : arr) v = (CRand63() % 2000001 - 1000000) / 7.0;
+    std::vector<double> expected = arr;
+    std::sort(std::begin(expected), std::end(expected));
+    ParallelSort<4>(std::data(arr), std::data(arr) + n);
+    assert(arr == expected);
+  }
+  {
+    // Sample sort with a comparator and many equal values.
+    std::vector<std::pair<int, int>> arr(n);
+    for (int i = 0; i < n; ++i) arr[i] = {CRand63() % 10, i};
+    std::vector<std::pair<int, int>> expected = arr;
+    auto cmp = [](const auto& a, const auto& b) { return a > b; };
+    std::sort(std::begin(expected), std::end(expected), cmp);
+    ParallelSort<5>(std::data(arr), std::data(arr) + n, cmp);
+    assert(arr == expected);
+  }
+  {
+    // Radix sort of records by key is stable.
+    std::vector<PrimePiItem> arr(n);
+    for (int i = 0; i < n; ++i) arr[i] = PrimePiItem(CRand63() % 1000, i);
+    std::vector<PrimePiItem> expected = arr;
+    std::stable_sort(std::begin(expected), std::end(expected));
+    ParallelRadixSort<6>(std::data(arr), std::data(arr) + n,
+                         [](const PrimePiItem& v) { return v.n; });
+    for (int i = 0; i < n; ++i) {
+      assert(arr[i].n == expected[i].n && arr[i].value == expected[i].value);
+    }
+  }
+}
+
+PE_REGISTER_TEST(&ParallelSortTypesTest, "ParallelSortTypesTest", SMALL);
+
+SL void ParallelSampleSortEqualKeysTest() {
+  // Only the first member is compared, so the keys are all equal or have
+  // a few distinct values.
+  auto cmp = [](const auto& a, const auto& b) { return a.first < b.first; };
+  for (int distinct : {1, 2, 3, 100}) {
+    std::vector<std::pair<int, int>> arr(n);
+    for (int i = 0; i < n; ++i) {
+      arr[i] = {static_cast<int>(CRand63() % distinct), i};
+    }
+    ParallelSampleSort<4>(std::data(arr), std::data(arr) + n, cmp);
+    assert(std::is_sorted(std::begin(arr), std::end(arr), cmp));
+    std::vector<int> ids(n);
+    for (int i = 0; i < n; ++i) ids[i] = arr[i].second;
+    std::sort(std::begin(ids), std::end(ids));
+    for (int i = 0; i < n; ++i) assert(ids[i] == i);
+  }
+}
+
+PE_REGISTER_TEST(&ParallelSampleSortEqualKeysTest,
+                 "ParallelSampleSortEqualKeysTest", SMALL);
+
+// A type without a default constructor.
+struct Boxed {
+  explicit Boxed(int64 v) : v(v) {}
+  int64 v;
+};
+
+SL void ParallelSortNoDefaultConstructorTest() {
+  std::vector<Boxed> arr;
+  for (int i = 0; i < n; ++i) arr.emplace_back(CRand63() % 100000);
+  std::vector<int64> expected;
+  for (const auto& item : arr) expected.push_back(item.v);
+  std::sort(std::begin(expected), std::end(expected));
+
+  std::vector<Boxed> sorted = arr;
+  ParallelSort<4>(std::data(sorted), std::data(sorted) + n,
+                  [](const Boxed& a, const Boxed& b) { return a.v < b.v; });
+  for (int i = 0; i < n; ++i) assert(sorted[i].v == expected[i]);
+
+  sorted = arr;
+  ParallelRadixSort<4>(std::data(sorted), std::data(sorted) + n,
+                       [](const Boxed& a) { return a.v; });
+  for (int i = 0; i < n; ++i) assert(sorted[i].v == expected[i]);
+}
+
+PE_REGISTER_TEST(&ParallelSortNoDefaultConstructorTest,
+                 "ParallelSortNoDefaultConstructorTest", SMALL);
 }  // namespace parallel_sort_test
@@ -8,6 +8,7 @@
 #include "bi_div_test.c"
 #include "bi_mul_test.c"
 #include "bit_test.c"
+#include "db_test.c"
 #include "dva_test.c"
 #include "extended_signed_int_test.c"
 #include "extended_unsigned_int_test.c"
@@ -19,10 +20,13 @@
 #include "mod_test.c"
 #include "mpf_test.c"
 #include "nt_test.c"
+#include "parallel_find_test.c"
+#include "parallel_reducer_test.c"
 #include "parallel_sort_test.c"
 #include "poly_algo_test.c"
 #include "poly_div_test.c"
 #include "poly_mul_test.c"
+#include "task_scheduler_test.c"
 #include "fft_test.c"
 #include "fraction_test.c"
 #include "int_algo_test.c"
@@ -44,6 +44,18 @@ SL void PolyMultiPointEvaluationTest() {
 PE_REGISTER_TEST(&PolyMultiPointEvaluationTest, "PolyMultiPointEvaluationTest",
                  SMALL);
 
+SL void PolyInterpolateTest() {
+  for (int64 n : {1, 2, 3, 17, 1000}) {
+    std::vector<int64> x(n), v(n);
+    for (auto& c : x) c = CRand63() % mod;
+    for (int64 i = 0; i < n; ++i) v[i] = (i * i + 7) % mod;
+    const std::vector<int64> y = PolyMultipointEvaluateNormal(x, v, mod);
+    assert(y == PolyMultipointEvaluateBls(x, v, mod));
+    assert(PolyInterpolate(v, y, mod) == x);
+  }
+}
+PE_REGISTER_TEST(&PolyInterpolateTest, "PolyInterpolateTest", SMALL);
+
 SL void PolyBatchMulTest() {
   const int mod = 10007;
   std::vector<int64> data = {1, 1, 2, 1, 3, 1};
@@ -54,6 +66,50 @@ SL void PolyBatchMulTest() {
 }
 PE_REGISTER_TEST(&PolyBatchMulTest, "PolyBatchMulTest", SMALL);
 
+SL std::vector<int64> TruncPoly(std::vector<int64> x, int64 n) {
+  x.resize(n);
+  return x;
+}
+
+SL void PolyNewtonTest() {
+  for (int64 n : {1, 2, 3, 10, 100, 1000}) {
+    std::vector<int64> x(n), y(n);
+    for (auto& v : x) v = CRand63() % mod;
+    for (auto& v : y) v = CRand63() % mod;
+    x[0] = 0;
+    y[0] = 1;
+
+    const std::vector<int64> e = pmod::PolyExp(x, n, mod);
+    assert(pmod::PolyLog(e, n, mod) == x);
+
+    const std::vector<int64> s = pmod::PolySqrt(y, n, mod);
+    assert(TruncPoly(PolyMul(s, s, mod), n) == y);
+  }
+}
+PE_REGISTER_TEST(&PolyNewtonTest, "PolyNewtonTest", SMALL);
+
+SL void PolyPowerTruncTest() {
+  for (int64 pm : std::vector<int64>{mod, 1000}) {
+    for (int64 k : {0, 1, 3}) {
+      std::vector<int64> x(20);
+      for (int64 i = k; i < 20; ++i) x[i] = CRand63() % pm;
+      x[k] = 1 + CRand63() % (pm - 1);
+      for (int64 e : {1, 2, 7, 30}) {
+        const int64 trunc = 50;
+        std::vector<int64> expected{1};
+        for (int64 i = 0; i < e; ++i) {
+          expected = TruncPoly(PolyMul(expected, x, pm), trunc);
+        }
+        AdjustPolyLeadingZero(expected);
+        assert(PolyPowerTrunc(x, e, trunc, pm) == expected);
+      }
+    }
+  }
+  assert(PolyPower(std::vector<int64>{1, 1}, 3, mod) ==
+         (std::vector<int64>{1, 3, 3, 1}));
+}
+PE_REGISTER_TEST(&PolyPowerTruncTest, "PolyPowerTruncTest", SMALL);
+
 SL void GenBernoulliNumberTest() {
   const int mod = 10007;
   assert((GenBernoulliNumber(7, mod) ==
@@ -162,6 +218,128 @@ SL void LinearRecurrenceTest() {
 }
 PE_REGISTER_TEST(&LinearRecurrenceTest, "LinearRecurrenceTest", SMALL);
 
+// The extended Euclidean algorithm without half-gcd.
+SL std::vector<int64> FindLinearRecurrenceNormal(Span<const int64> terms,
+                                                 int64 mod) {
+  const int64 m = static_cast<int64>(std::size(terms));
+  std::vector<int64> r0(m + 1, 0), r1(m), v0 = {0}, v1 = {1};
+  r0[m] = 1;
+  for (int64 i = 0; i < m; ++i) r1[i] = terms[m - 1 - i];
+  AdjustPolyLeadingZero(r1);
+  while (m / 2 + 1 <= static_cast<int64>(std::size(r1))) {
+    auto [q, r] = PolyDivAndMod(r0, r1, mod);
+    std::vector<int64> v = PolySub(v0, PolyMul(q, v1, mod), mod);
+    v0 = std::move(v1);
+    v1 = std::move(v);
+    r0 = std::move(r1);
+    r1 = std::move(r);
+  }
+  AdjustPolyLeadingZero(v1);
+  const int64 c = ModInv(v1.back(), mod);
+  for (int64& v : v1) v = MulMod(c, v, mod);
+  return v1;
+}
+
+SL void FindLinearRecurrenceHalfGcdTest() {
+  const int64 mod = 1000000007;
+  for (int order : {0, 1, 5, 100, 200, 700}) {
+    std::vector<int64> char_poly(order + 1, 1);
+    for (int i = 0; i < order; ++i) char_poly[i] = CRand63() % mod;
+    // A zero constant term makes terms[0] irrelevant.
+    if (order > 0) char_poly[0] = 0;
+    std::vector<int64> terms(order);
+    for (int i = 0; i < order; ++i) terms[i] = CRand63() % mod;
+    while (static_cast<int>(std::size(terms)) < 2 * order + 10) {
+      terms.push_back(LinearRecurrenceValueNext(char_poly, terms, mod));
+    }
+    std::vector<int64> found = *FindLinearRecurrence(terms, mod);
+    assert(VerifyLinearRecurrence(found, terms, mod));
+    assert(static_cast<int>(std::size(found)) <= order + 1);
+    const int64 m = static_cast<int64>(std::size(terms)) / 2 * 2;
+    const Span<const int64> even_terms = Span<const int64>(terms).subspan(0, m);
+    assert(internal::FindLinearRecurrence(even_terms, mod) ==
+           FindLinearRecurrenceNormal(even_terms, mod));
+  }
+  // Random terms have no short recurrence.
+  for (int m : {2, 10, 300, 1000}) {
+    std::vector<int64> terms(m);
+    for (int i = 0; i < m; ++i) terms[i] = CRand63() % mod;
+    terms[m - 1] = 0;
+    assert(internal::FindLinearRecurrence(terms, mod) ==
+           FindLinearRecurrenceNormal(terms, mod));
+  }
+  {
+    // a[n] = -a[n-1] + 3 a[n-2] + 2 a[n-3]
+    std::vector<int64> terms = {1, -2, 7};
+    for (int i = 3; i < 20; ++i) {
+      terms.push_back(-terms[i - 1] + 3 * terms[i - 2] + 2 * terms[i - 3]);
+    }
+    assert(*FindIntegerLinearRecurrence(terms) ==
+           (std::vector<int64>{-2, -3, 1, 1}));
+  }
+}
+PE_REGISTER_TEST(&FindLinearRecurrenceHalfGcdTest,
+                 "FindLinearRecurrenceHalfGcdTest", SMALL);
+
+SL void MatrixPowerCharPolyTest() {
+  {
+    // det(xI - {{1, 2}, {3, 4}}) = x^2 - 5x - 2
+    PeMatrix<int64> m(2, 2);
+    m(0, 0) = 1, m(0, 1) = 2, m(1, 0) = 3, m(1, 1) = 4;
+    assert(MatrixCharPoly(m, 1000000007) ==
+           (std::vector<int64>{1000000005, 1000000002, 1}));
+  }
+  for (int64 mod : std::vector<int64>{2, 97, 1000000007, 1000000000000000003}) {
+    for (int d : {1, 2, 7, 40}) {
+      PeMatrix<int64> m(d, d);
+      std::vector<int64> v(d);
+      for (int i = 0; i < d; ++i) {
+        v[i] = CRand63() % mod;
+        for (int j = 0; j < d; ++j) {
+          // Sparse rows and columns need pivoting in the Hessenberg reduction.
+          m(i, j) = (i + j) % 3 == 0 ? 0 : CRand63() % mod;
+        }
+      }
+      for (int64 n : std::vector<int64>{0, 1, 5, 123456789}) {
+        assert(MatrixPowerCharPoly(m, n, v, mod) ==
+               MatrixPowerPe(m, n, v, mod));
+      }
+    }
+  }
+}
+PE_REGISTER_TEST(&MatrixPowerCharPolyTest, "MatrixPowerCharPolyTest", SMALL);
+
+SL void LinearRecurrenceValuesAtTest() {
+  for (int64 mod : std::vector<int64>{1000000007, 998244353, 97}) {
+    for (int k : {1, 3, 100, 300}) {
+      std::vector<int64> char_poly(k + 1), terms(k);
+      for (int i = 0; i < k; ++i) {
+        char_poly[i] = (i * 37 + 11) % mod;
+        terms[i] = (i * i + 5) % mod;
+      }
+      char_poly[k] = 1;
+      std::vector<int64> seq(terms);
+      for (int i = k; i < 2000; ++i) {
+        int64 v = 0;
+        for (int j = 0; j < k; ++j) {
+          v = AddMod(v, MulMod(seq[i - k + j], char_poly[j], mod), mod);
+        }
+        seq.push_back(v == 0 ? 0 : mod - v);
+      }
+      std::vector<int64> ns = {0, 1999, k, 1000, 1, 1024, 777};
+      std::vector<int64> values =
+          LinearRecurrenceValuesAt(char_poly, terms, ns, mod);
+      for (int i = 0; i < static_cast<int>(std::size(ns)); ++i) {
+        assert(values[i] == seq[ns[i]]);
+        assert(LinearRecurrenceValueAt(char_poly, terms, ns[i], mod) ==
+               seq[ns[i]]);
+      }
+    }
+  }
+}
+PE_REGISTER_TEST(&LinearRecurrenceValuesAtTest, "LinearRecurrenceValuesAtTest",
+                 SMALL);
+
 SL void SeqExprTest() {
   {
     Sequence a;
@@ -282,5 +282,87 @@ void PolyMulExtendedInt() {
 #endif
 }
 PE_REGISTER_TEST(&PolyMulExtendedInt, "PolyMulExtendedInt", SMALL);
+
+// Covers the sizes handled by the scalar and the vectorized ntt32 kernels.
+void Ntt32SizeTest() {
+  for (int64 mod : {997, 1000000007}) {
+    for (int64 n = 1; n <= 300; n += n < 40 ? 1 : 37) {
+      for (int64 m : std::vector<int64>{1, 7, n, 2 * n + 3}) {
+        std::vector<uint64> x(n), y(m);
+        for (auto& v : x) v = CRand63() % mod;
+        for (auto& v : y) v = CRand63() % mod;
+        std::vector<uint64> expected(n + m - 1);
+        for (int64 i = 0; i < n; ++i) {
+          for (int64 j = 0; j < m; ++j) {
+            expected[i + j] =
+                AddMod(expected[i + j], MulMod(x[i], y[j], mod), mod);
+          }
+        }
+        if (mod < 1000) {
+          assert(ntt32::PolyMulSmall<uint64>(x, y, mod) == expected);
+        }
+        assert(ntt32::PolyMulLarge<uint64>(x, y, mod) == expected);
+      }
+    }
+  }
+}
+PE_REGISTER_TEST(&Ntt32SizeTest, "Ntt32SizeTest", SMALL);
+
+void NttPlanTest() {
+  for (int64 mod : std::vector<int64>{997, 1000000007, 999999999989}) {
+    for (int64 n : {1, 5, 300, 5000}) {
+      std::vector<uint64> a(n), b(n), c(n / 2 + 1);
+      for (auto& v : a) v = CRand63() % mod;
+      for (auto& v : b) v = CRand63() % mod;
+      for (auto& v : c) v = CRand63() % mod;
+      const std::vector<uint64> ab = ntt32::PolyMul<uint64>(a, b, mod);
+      const std::vector<uint64> abc = ntt32::PolyMul<uint64>(ab, c, mod);
+
+      ntt32::NttPlan plan(sz(abc), mod);
+      const ntt32::PolySpectrum sa = plan.Transform(a);
+      assert(plan.ToPoly<uint64>(sa) == a);
+      assert(plan.Multiply(b, sa) == ab);
+      assert(plan.Multiply(ab, plan.Transform(c)) == abc);
+
+      ntt32::PolySpectrum s = plan.Transform(b);
+      plan.MulInPlace(&s, sa);
+      assert(plan.ToPoly<uint64>(s) == ab);
+      assert(plan.Multiply<uint64>(sa, plan.Transform(b)) == ab);
+    }
+  }
+}
+PE_REGISTER_TEST(&NttPlanTest, "NttPlanTest", SMALL);
+
+#if HAS_POLY_MUL_NTT64
+// Covers the transforms running in cache-sized blocks, of 2^15 and 2^16
+// values.
+void Ntt32BlockTest() {
+  const int64 mod = 1000000007;
+  for (int64 n : {40000, 70000, 150000}) {
+    std::vector<uint64> x(n), y(n + 1);
+    for (auto& v : x) v = CRand63() % mod;
+    for (auto& v : y) v = CRand63() % mod;
+    const std::vector<uint64> expected = ntt64::PolyMulLarge<uint64>(x, y, mod);
+    assert(ntt32::PolyMulLarge<uint64>(x, y, mod) == expected);
+  }
+
+  // The passes of a transform running as a task, as in RunNttN, get more
+  // than one thread.
+  SetParallelConcurrency(4);
+  std::mutex lock;
+  std::set<std::thread::id> threads;
+  const int64 n = ntt32::internal::kNttParallelSize;
+  ParallelFor(0, 1, [&](int64) {
+    ntt32::internal::NttForEachChunk(n, n, n, [&](int64, int64, int64) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      std::lock_guard<std::mutex> guard(lock);
+      threads.insert(std::this_thread::get_id());
+    });
+  });
+  assert(std::size(threads) > 1);
+  SetParallelConcurrency(0);
+}
+PE_REGISTER_TEST(&Ntt32BlockTest, "Ntt32BlockTest", SMALL);
+#endif
 #endif
 }  // namespace poly_mul_test
@@ -0,0 +1,137 @@
+#include "pe_test.h"
+
+namespace task_scheduler_test {
+SL int64 Fib(int n) {
+  if (n < 2) return n;
+  int64 a = 0;
+  int64 b = 0;
+  TaskGroup group;
+  if (n > 15) {
+    group.Spawn([&]() { a = Fib(n - 1); });
+  } else {
+    a = Fib(n - 1);
+  }
+  b = Fib(n - 2);
+  group.Sync();
+  return a + b;
+}
+
+SL void TaskSchedulerTest() {
+  for (int concurrency : {1, 3, 0}) {
+    SetParallelConcurrency(concurrency);
+
+    assert(Fib(25) == 75025);
+
+    constexpr int64 n = 1000000;
+    std::vector<int64> data(n);
+    ParallelFor(0, n, [&](int64 i) { data[i] = i * i; });
+    for (int64 i = 0; i < n; ++i) assert(data[i] == i * i);
+
+    // The loops nested in an OpenMP region run inline.
+    std::vector<int64> sums(64);
+#if ENABLE_OPENMP
+#pragma omp parallel for num_threads(4)
+#endif
+    for (int i = 0; i < 64; ++i) {
+      PSum<int64> sum;
+      ParallelLoop(0, 1000, [&](int64 j) { sum += i * j; }, 8, 10);
+      sums[i] = sum.value();
+    }
+    for (int i = 0; i < 64; ++i) assert(sums[i] == i * 499500LL);
+
+    std::vector<int> hits(100);
+    std::vector<std::function<void()>> functions;
+    for (int i = 0; i < 100; ++i) functions.push_back([&, i]() { ++hits[i]; });
+    ParallelExecute(functions);
+    for (int i = 0; i < 100; ++i) assert(hits[i] == 1);
+
+    // An unbounded search must terminate even if the tasks run one by one.
+    std::atomic<int64> found{0};
+    TaskGroup group;
+    group.Spawn([&]() {
+      found = ParallelFindFirst<4, int64>(
+          1, [](int64 x) { return x >= 123456789 && x % 1000 == 7; });
+    });
+    group.Sync();
+    assert(found == 123457007);
+    assert((ParallelFindLast<4, int64>(
+               100000000, [](int64 x) { return x % 9876543 == 0; })) ==
+           98765430);
+  }
+  SetParallelConcurrency(0);
+}
+
+PE_REGISTER_TEST(&TaskSchedulerTest, "TaskSchedulerTest", SMALL);
+
+SL void TaskGroupTest() {
+#if !ENABLE_OPENMP
+  // Serial unless asked for threads.
+  assert(ParallelConcurrency() == 1);
+#endif
+  TaskScheduler scheduler(4);
+
+  // A throwing task still finishes the group, and Sync rethrows.
+  std::atomic<int> done{0};
+  TaskGroup group(scheduler);
+  for (int i = 0; i < 100; ++i) {
+    group.Spawn([&, i]() {
+      if (i == 37) throw std::runtime_error("task");
+      ++done;
+    });
+  }
+  bool thrown = false;
+  try {
+    group.Sync();
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  assert(thrown && done == 99);
+  group.Sync();
+
+  // The waiting thread blocks while a long task runs elsewhere.
+  group.Spawn([&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ++done;
+  });
+  group.Sync();
+  assert(done == 100);
+
+  // The OpenMP regions in a task get a single thread.
+  std::atomic<int> team_size{0};
+  group.Spawn([&]() {
+#if ENABLE_OPENMP
+#pragma omp parallel
+#endif
+    ++team_size;
+  });
+  group.Sync();
+  assert(team_size == 1);
+  assert(!TaskScheduler::InTask());
+
+#if ENABLE_OPENMP
+  // In an OpenMP team the work stays on the calling thread, so the team and
+  // the scheduler workers do not oversubscribe.
+  SetParallelConcurrency(4);
+  // A dynamic team may shrink to one thread, which is not a region.
+  const int dynamic = omp_get_dynamic();
+  omp_set_dynamic(0);
+  std::atomic<int> other_thread{0};
+#pragma omp parallel num_threads(4)
+  {
+    const std::thread::id id = std::this_thread::get_id();
+    auto check = [&]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      other_thread += std::this_thread::get_id() != id;
+    };
+    ParallelInvoke(true, check, check);
+    ParallelLoop(0, 10, [&](int64) { check(); });
+    ParallelFor(0, 10, [&](int64) { check(); });
+  }
+  assert(other_thread == 0);
+  omp_set_dynamic(dynamic);
+  SetParallelConcurrency(0);
+#endif
+}
+
+PE_REGISTER_TEST(&TaskGroupTest, "TaskGroupTest", SMALL);
+}  // namespace task_scheduler_test